@@ -20,6 +20,7 @@ let noiseCoef = noiseCoef0;
 let pending = 0;
 let batch_i = 0;
 let opsEMA=0, startTime, batchOps;
+let skipFrac=0, skipOps=0;
 let running=true;
 let inspectIdx = 0;
 let mouseXY = [0,0];
@@ -99,8 +100,11 @@ function scheduleBatch() {
         needReset = false;
     }
     startTime = Date.now();
-    batchOps = 0;
     const pair_n = main.prepare_batch();
+    const skip_n = main.batch_skip_n[0];
+    batchOps = 0;
+    skipOps = main.batch_skip_ops[0];
+    skipFrac = skip_n / Math.max(skip_n+pair_n, 1);
     
     // Update global effects in the main WASM module
     if (useGlobalEffects) {
@@ -121,6 +125,7 @@ function scheduleBatch() {
             batch: main.batch.slice(start*tape_len*2, end*tape_len*2),
             ofs: start,
             pair_n: end-start,
+            step_n: main.get_pair_step_n(),
             useGlobalEffects,
             globalTemperature,
             globalEnergy,
@@ -139,7 +144,8 @@ function onmessage(e) {
         return;
     }
     main.absorb_batch();
-    const pair_n = main.batch_pair_n[0];
+    // skipped pairs still count as interactions for the noise rate
+    const pair_n = main.batch_pair_n[0] + main.batch_skip_n[0];
     main.mutate(pair_n*noiseCoef);
     ++batch_i;
     const op_per_sec = batchOps / ((Date.now()-startTime)/1000.0);
@@ -242,7 +248,7 @@ function frame() {
     
     main.updateCounts();
     const writes = main.write_count.reduce((a,b)=>a+b, 0);
-    const lines = [`batch_i: ${batch_i}\nwrites: ${writes}\nop/s: ${(opsEMA/1e6).toFixed(2)}M\n`]
+    const lines = [`batch_i: ${batch_i}\nwrites: ${writes}\nop/s: ${(opsEMA/1e6).toFixed(2)}M\nskipped: ${(skipFrac*100).toFixed(1)}% (${(skipOps/1e3).toFixed(1)}K ops/batch)\n`]
     lines.push('Top codes (count, byte, asm):')
     const count_byte = Array.from(main.counts).map((v,i)=>[v,i]).sort((a,b)=>b[0]-a[0]);
     for (const [count, byte] of count_byte.slice(0,20)) {
@@ -24,7 +24,7 @@ self.onmessage = async e => {
         }
     }
     
-    const totalOps = wasm.run(msg.pair_n, 128);
+    const totalOps = wasm.run(msg.pair_n, msg.step_n);
     const pair_n = msg.pair_n;
     self.postMessage({
         batch: wasm.batch.slice(0, msg.batch.length),
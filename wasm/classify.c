@@ -0,0 +1,92 @@
+#include "classify.h"
+#include "common.h"
+#include <stdbool.h>
+
+// Opcode decoding below mirrors the exec_opcode* switches in external/z80.c.
+// Every offset of the wrapped pair is treated as a potential instruction
+// start, so the result holds for any control flow the CPU could take.
+
+// unprefixed opcodes that call wb/ww/pushw
+static bool base_writes(uint8_t op) {
+    switch (op) {
+    case 0x02: case 0x12: case 0x22: case 0x32: // ld (bc|de|**),a / ld (**),hl
+    case 0x34: case 0x35: case 0x36:            // inc/dec/ld (hl)
+    case 0x70: case 0x71: case 0x72: case 0x73:
+    case 0x74: case 0x75: case 0x77:            // ld (hl),r
+    case 0xC4: case 0xCC: case 0xD4: case 0xDC:
+    case 0xE4: case 0xEC: case 0xF4: case 0xFC:
+    case 0xCD:                                  // call / call cc
+    case 0xC7: case 0xCF: case 0xD7: case 0xDF:
+    case 0xE7: case 0xEF: case 0xF7: case 0xFF: // rst
+    case 0xC5: case 0xD5: case 0xE5: case 0xF5: // push
+    case 0xE3:                                  // ex (sp),hl
+        return true;
+    }
+    return false;
+}
+
+// CB opcodes write (hl) back for every z == 6 form, bit included
+static bool cb_writes(uint8_t op) {
+    return (op & 7) == 6;
+}
+
+// DD/FD CB d op writes (iz+d) for everything except bit
+static bool dcb_writes(uint8_t op) {
+    return (op >> 6) != 1;
+}
+
+static bool ed_writes(uint8_t op) {
+    switch (op) {
+    case 0x43: case 0x53: case 0x63: case 0x73: // ld (**),rr
+    case 0x67: case 0x6F:                       // rrd, rld
+    case 0xA0: case 0xA8: case 0xB0: case 0xB8: // ldi, ldd, ldir, lddr
+    case 0xA2: case 0xAA: case 0xB2: case 0xBA: // ini, ind, inir, indr
+        return true;
+    }
+    return false;
+}
+
+// DD/FD opcodes with their own write path; the rest fall back to the
+// unprefixed opcode, which is checked at the next offset anyway
+static bool ddfd_writes(uint8_t op) {
+    switch (op) {
+    case 0x22: case 0x34: case 0x35: case 0x36:
+    case 0x70: case 0x71: case 0x72: case 0x73:
+    case 0x74: case 0x75: case 0x77:
+    case 0xE3: case 0xE5:
+        return true;
+    }
+    return false;
+}
+
+static bool may_write_at(const uint8_t* pair, int ofs) {
+    const uint8_t op = pair[ofs];
+    const uint8_t op1 = pair[(ofs+1) & (PAIR_LENGTH-1)];
+    switch (op) {
+    case 0xCB: return cb_writes(op1);
+    case 0xED: return ed_writes(op1);
+    case 0xDD: case 0xFD:
+        if (op1 == 0xCB) {
+            return dcb_writes(pair[(ofs+3) & (PAIR_LENGTH-1)]);
+        }
+        return ddfd_writes(op1);
+    }
+    return base_writes(op);
+}
+
+int classify_pair(const uint8_t* pair, int step_n) {
+    // halt as the very first instruction: one step, nothing else runs
+    if (pair[0] == 0x76) {
+        return 1;
+    }
+    bool may_halt = false;
+    for (int i=0; i<PAIR_LENGTH; ++i) {
+        if (may_write_at(pair, i)) {
+            return -1;
+        }
+        // DD/FD 76 halts too, but that 76 is seen at the next offset
+        may_halt |= pair[i] == 0x76;
+    }
+    // without writes or a reachable halt the worker runs all step_n steps
+    return may_halt ? -1 : step_n;
+}
@@ -0,0 +1,11 @@
+#ifndef CLASSIFY_H
+#define CLASSIFY_H
+
+#include <stdint.h>
+
+// Statically decides whether a PAIR_LENGTH byte pair can be skipped.
+// Returns the exact number of z80_step calls the worker would make if the
+// pair provably never writes memory, or -1 if the pair has to be executed.
+int classify_pair(const uint8_t* pair, int step_n);
+
+#endif // CLASSIFY_H
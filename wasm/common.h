@@ -16,6 +16,8 @@
 
 enum {
     TAPE_LENGTH = 16, // must be 2 ** N
+    PAIR_LENGTH = TAPE_LENGTH * 2,
+    PAIR_STEP_N = 128, // z80_step calls per pair
     MAX_BATCH_PAIR_N = 1024*8
 };
 
@@ -2,6 +2,7 @@
 #include "math.h"
 #include "region.h"
 #include "region_grid.h"
+#include "classify.h"
 #include <stddef.h> // This defines NULL
 #include <stdbool.h>
 
@@ -27,6 +28,8 @@ BUFFER(batch_pair_n, int, 1)
 BUFFER(batch_idx, int, MAX_BATCH_PAIR_N*2)
 BUFFER(batch, uint8_t, MAX_BATCH_PAIR_N*2*TAPE_LENGTH)
 BUFFER(batch_write_count, int, MAX_BATCH_PAIR_N*2)
+BUFFER(batch_skip_n, int, 1)
+BUFFER(batch_skip_ops, int, 1)
 BUFFER(rng_state, uint64_t, 1)
 
 static bool use_global_effects = true;
@@ -39,6 +42,7 @@ static float global_randomness = 0.0f;
 WASM_EXPORT("get_tape_len") int get_tape_len() {return TAPE_LENGTH;}
 WASM_EXPORT("get_soup_width") int get_soup_width() {return SOUP_WIDTH;}
 WASM_EXPORT("get_soup_height") int get_soup_height() {return SOUP_HEIGHT;}
+WASM_EXPORT("get_pair_step_n") int get_pair_step_n() {return PAIR_STEP_N;}
 
 uint64_t rand64(/*uint64_t seed*/) {
   uint64_t z = (rng_state[0] += 0x9e3779b97f4a7c15);
@@ -134,12 +138,13 @@ static float custom_powf(float base, float exponent) {
 
 WASM_EXPORT("prepare_batch") int prepare_batch() {
     int pair_n = 0, collision_count=0, pos=0;
+    int skip_n = 0, skip_ops = 0;
     uint8_t mask[TAPE_N] = {0};
     float global_temperature = 1.0f;
     float global_energy = 1.0f;
     float global_randomness = 0.0f;
 
-    while (pair_n<MAX_BATCH_PAIR_N && collision_count<16) {
+    while (pair_n+skip_n<MAX_BATCH_PAIR_N && collision_count<16) {
         uint64_t rnd = rand64();
         int dir = (rnd&1)*2-1; rnd>>=1;
         int horizontal = rnd&1; rnd>>=1;
@@ -195,20 +200,33 @@ WASM_EXPORT("prepare_batch") int prepare_batch() {
         if (!found_partner) { ++collision_count; continue; }
 
         mask[i] = mask[j] = 1;
-        batch_idx[2*pair_n] = i;
-        batch_idx[2*pair_n+1] = j;
+        collision_count = 0;
         for (int k=0; k<TAPE_LENGTH; ++k) {
             batch[pos+k] = soup[i*TAPE_LENGTH+k];
             batch[pos+k+TAPE_LENGTH] = soup[j*TAPE_LENGTH+k];
         }
-        pos += TAPE_LENGTH*2;
-        pair_n++;
-        collision_count = 0;
 
         // Apply randomness factor if non-neutral
+        bool randomized = false;
         if (region->randomness_factor != 0.0f && rand64() % 1000 < region->randomness_factor * 1000) {
-            batch[pos-1] = rand64() & 0xFF;
+            batch[pos+PAIR_LENGTH-1] = rand64() & 0xFF;
+            randomized = true;
         }
+
+        // Pairs that provably never write are left out of the batch:
+        // running them and copying them back would not change the soup
+        int ops = randomized ? -1 : classify_pair(batch+pos, PAIR_STEP_N);
+        if (ops >= 0) {
+            write_count[i] = write_count[j] = 0;
+            skip_ops += ops;
+            skip_n++;
+            continue;
+        }
+
+        batch_idx[2*pair_n] = i;
+        batch_idx[2*pair_n+1] = j;
+        pos += PAIR_LENGTH;
+        pair_n++;
     }
 
     if (use_global_effects) {
@@ -230,6 +248,8 @@ WASM_EXPORT("prepare_batch") int prepare_batch() {
     }
 
     batch_pair_n[0] = pair_n;
+    batch_skip_n[0] = skip_n;
+    batch_skip_ops[0] = skip_ops;
     return pair_n;
 }
 
@@ -7,8 +7,6 @@ FILE * const stderr=NULL;
 int fprintf(FILE *stream, const char *format, ...) {return 0;}
 #endif
 
-enum { PAIR_LENGTH = TAPE_LENGTH * 2 };
-
 BUFFER(batch, uint8_t, MAX_BATCH_PAIR_N * PAIR_LENGTH);
 BUFFER(write_count, int, MAX_BATCH_PAIR_N);
 